@@ -18,6 +18,11 @@
 #include <random>
 #include <iostream>
 #include <set>
+#include <vector>
+#include <cstring>
+#include <thread>
+#include <functional>
+#include <algorithm>
 #ifdef DEEP_TEST_ULTRA_SIMPLE_UUIDS
 #include <cassert>
 #endif //DEEP_TEST_ULTRA_SIMPLE_UUIDS
@@ -97,43 +102,62 @@ namespace UltraSimpleUUID {
         ///@brief: Get the string version of this UUID
         std::string toString() {
             std::string uuid = std::string(UUID_STR_LEN, '-');
-            int i = 0;
-            for (int n = 0; n < UUID_NUM_CHARS; n++)
-            {
-                if (HYPHEN_POSITIONS.find(i) != HYPHEN_POSITIONS.end())
-                    i++;
-                uuid[i] = CHARS[extractIntFromPosition(n)];
-                i++;
-            }
+            toChars(&uuid[0]);
 #ifdef DEEP_TEST_ULTRA_SIMPLE_UUIDS
             for (int hyphen_position : HYPHEN_POSITIONS)
             {
                 assert(uuid[hyphen_position] == '-');
             }
-#endif DEEP_TEST_ULTRA_SIMPLE_UUIDS
+#endif //DEEP_TEST_ULTRA_SIMPLE_UUIDS
             return uuid;
         }
 
-        
-        ///@brief: Set UUID from a string. Returs false if string is malformed.
-        bool fromString(std::string inString)
+        ///@brief: Write the string version of this UUID into outChars without allocating. Writes exactly UUID_STR_LEN chars, no null terminator.
+        void toChars(char* outChars) const
         {
-            // check the string is well formed
-            if (inString.length() != UUID_STR_LEN) { return false; }
-            for (int hyphen_position : HYPHEN_POSITIONS)
+            auto next_hyphen = HYPHEN_POSITIONS.begin(); // walk the sorted positions alongside i rather than looking each one up
+            int n = 0;
+            for (int i = 0; i < UUID_STR_LEN; i++)
             {
-                if (inString[hyphen_position] != '-') { return false; }
+                if (next_hyphen != HYPHEN_POSITIONS.end() && i == *next_hyphen)
+                {
+                    outChars[i] = '-';
+                    ++next_hyphen;
+                }
+                else
+                    outChars[i] = CHARS[extractIntFromPosition(n++)];
             }
+        }
+
+        ///@brief: Set UUID from UUID_STR_LEN chars without allocating. Returns false (and leaves the UUID untouched) if malformed.
+        bool fromChars(const char* inChars)
+        {
+            int32_t values[6] = { 0,0,0,0,0,0 };                        // parse into a zeroed copy so bits only need setting
+            auto next_hyphen = HYPHEN_POSITIONS.begin();
             int char_pos = 0;
-            for (int i = 0; i < inString.length(); i++)
+            for (int i = 0; i < UUID_STR_LEN; i++)
             {
-                if (HYPHEN_POSITIONS.find(i) != HYPHEN_POSITIONS.end())
-                    i++;
-                std::size_t found = CHARS.find(inString[i]);
-                if (found == std::string::npos) { return false; } // there's an illegal character in the string
-                encodeIntAtPosition(found, char_pos);
+                if (next_hyphen != HYPHEN_POSITIONS.end() && i == *next_hyphen)
+                {
+                    if (inChars[i] != '-') { return false; }
+                    ++next_hyphen;
+                    continue;
+                }
+                int32_t found = charIndex(inChars[i]);
+                if (found < 0) { return false; } // there's an illegal character in the string
+                for (int bit_idx = 0; bit_idx < 6; bit_idx++)
+                    values[bit_idx] |= ((found >> bit_idx) & 1) << char_pos;
                 char_pos++;
             }
+            memcpy(mValues, values, BUFFER_SIZE);
+            return true;
+        }
+        
+        ///@brief: Set UUID from a string. Returs false (and leaves the UUID untouched) if string is malformed.
+        bool fromString(std::string inString)
+        {
+            if (inString.length() != UUID_STR_LEN) { return false; }
+            if (!fromChars(inString.data())) { return false; }
 #ifdef DEEP_TEST_ULTRA_SIMPLE_UUIDS
             assert(inString == toString());
 #endif //DEEP_TEST_ULTRA_SIMPLE_UUIDS
@@ -184,8 +208,17 @@ namespace UltraSimpleUUID {
             }
         }
 
+        ///@brief: Index of a character in CHARS, or -1 if it isn't there. Avoids the linear search of CHARS.find
+        static int32_t charIndex(char inChar)
+        {
+            if (inChar >= '0' && inChar <= '9') { return inChar - '0'; }
+            if (inChar >= 'A' && inChar <= 'Z') { return inChar - 'A' + 10; }
+            if (inChar >= 'a' && inChar <= 'z') { return inChar - 'a' + 36; }
+            return -1;
+        }
+
         ///@brief: extract a character index from the UUID at a given position
-        int32_t extractIntFromPosition(int inPosition)
+        int32_t extractIntFromPosition(int inPosition) const
         {
 #ifdef DEEP_TEST_ULTRA_SIMPLE_UUIDS
             assert(inPosition < UUID_NUM_CHARS);
@@ -206,4 +239,116 @@ namespace UltraSimpleUUID {
         throwaway_uuid.randomize();
         return throwaway_uuid.toString();
     }
+
+
+    /*
+    @brief: Runs inRunChunk(chunk_idx) for every chunk_idx in [0, inNumChunks) and returns once all have finished.
+    Pass your own to the *Parallel functions below to run the work on an existing thread pool.
+    */
+    typedef std::function<void(size_t inNumChunks, const std::function<void(size_t)>& inRunChunk)> Executor;
+
+    ///@brief: Executor that runs each chunk on its own std::thread (the calling thread takes chunk 0).
+    /// Throws std::system_error if a thread can't be created, after joining the ones that were.
+    inline void threadExecutor(size_t inNumChunks, const std::function<void(size_t)>& inRunChunk)
+    {
+        std::vector<std::thread> threads;
+        try
+        {
+            for (size_t chunk_idx = 1; chunk_idx < inNumChunks; chunk_idx++)
+                threads.emplace_back(inRunChunk, chunk_idx);
+            if (inNumChunks > 0)
+                inRunChunk(0);
+        }
+        catch (...)
+        {
+            // destroying a joinable std::thread terminates, so wait for the chunks already started before rethrowing
+            for (std::thread& t : threads)
+                t.join();
+            throw;
+        }
+        for (std::thread& t : threads)
+            t.join();
+    }
+
+    ///@brief: Number of chunks to split work into. 0 threads means one per hardware thread.
+    inline size_t parallelChunkCount(size_t inNumElements, unsigned inNumThreads)
+    {
+        if (inNumThreads == 0)
+            inNumThreads = std::max(1u, std::thread::hardware_concurrency());
+        return std::max<size_t>(1, std::min<size_t>(inNumThreads, inNumElements));
+    }
+
+    /*
+    @brief: Convert inCount UUIDs to strings using inExecutor. UUID i is written to outChars + i * inStride (UUID_STR_LEN chars,
+    no null terminator), so a stride larger than UUID_STR_LEN leaves room for separators. No per-element allocation.
+    inStride must be at least UUID_STR_LEN, otherwise elements would overlap and nothing is written.
+    An inNumChunks of 0 is treated as 1.
+    */
+    inline void toStringsParallel(const Uuid* inUuids, size_t inCount, char* outChars, const Executor& inExecutor, size_t inNumChunks,
+        size_t inStride = UUID_STR_LEN)
+    {
+#ifdef DEEP_TEST_ULTRA_SIMPLE_UUIDS
+        assert(inStride >= UUID_STR_LEN);
+#endif //DEEP_TEST_ULTRA_SIMPLE_UUIDS
+        if (inCount == 0 || inStride < UUID_STR_LEN) { return; }
+        inNumChunks = std::max<size_t>(1, std::min(inNumChunks, inCount));
+        size_t per_chunk = (inCount + inNumChunks - 1) / inNumChunks;
+        inExecutor(inNumChunks, [=](size_t chunk_idx) {
+            size_t end = std::min(inCount, (chunk_idx + 1) * per_chunk);
+            for (size_t i = chunk_idx * per_chunk; i < end; i++)
+                inUuids[i].toChars(outChars + i * inStride);
+        });
+    }
+
+    ///@brief: Convert inCount UUIDs to strings across inNumThreads threads (0 = all hardware threads). See above for output layout and stride.
+    inline void toStringsParallel(const Uuid* inUuids, size_t inCount, char* outChars, unsigned inNumThreads = 0,
+        size_t inStride = UUID_STR_LEN)
+    {
+        toStringsParallel(inUuids, inCount, outChars, threadExecutor, parallelChunkCount(inCount, inNumThreads), inStride);
+    }
+
+    /*
+    @brief: Parse inCount UUID strings read from inChars + i * inStride using inExecutor. If outValid is not null, outValid[i] is set
+    to whether string i was well formed; malformed strings leave outUuids[i] untouched. Returns the number of malformed strings.
+    inStride must be at least UUID_STR_LEN, otherwise every string is reported as malformed. An inNumChunks of 0 is treated as 1.
+    */
+    inline size_t fromStringsParallel(const char* inChars, size_t inCount, Uuid* outUuids, bool* outValid, const Executor& inExecutor,
+        size_t inNumChunks, size_t inStride = UUID_STR_LEN)
+    {
+#ifdef DEEP_TEST_ULTRA_SIMPLE_UUIDS
+        assert(inStride >= UUID_STR_LEN);
+#endif //DEEP_TEST_ULTRA_SIMPLE_UUIDS
+        if (inCount == 0) { return 0; }
+        if (inStride < UUID_STR_LEN)
+        {
+            if (outValid) { std::fill(outValid, outValid + inCount, false); }
+            return inCount;
+        }
+        inNumChunks = std::max<size_t>(1, std::min(inNumChunks, inCount));
+        size_t per_chunk = (inCount + inNumChunks - 1) / inNumChunks;
+        std::vector<size_t> chunk_failures(inNumChunks, 0);
+        size_t* failures = chunk_failures.data();
+        inExecutor(inNumChunks, [=](size_t chunk_idx) {
+            size_t end = std::min(inCount, (chunk_idx + 1) * per_chunk);
+            size_t chunk_failure_count = 0;
+            for (size_t i = chunk_idx * per_chunk; i < end; i++)
+            {
+                bool valid = outUuids[i].fromChars(inChars + i * inStride);
+                if (outValid) { outValid[i] = valid; }
+                if (!valid) { chunk_failure_count++; }
+            }
+            failures[chunk_idx] = chunk_failure_count;
+        });
+        size_t total_failures = 0;
+        for (size_t count : chunk_failures)
+            total_failures += count;
+        return total_failures;
+    }
+
+    ///@brief: Parse inCount UUID strings across inNumThreads threads (0 = all hardware threads). See above for input layout, stride and errors.
+    inline size_t fromStringsParallel(const char* inChars, size_t inCount, Uuid* outUuids, bool* outValid = nullptr,
+        unsigned inNumThreads = 0, size_t inStride = UUID_STR_LEN)
+    {
+        return fromStringsParallel(inChars, inCount, outUuids, outValid, threadExecutor, parallelChunkCount(inCount, inNumThreads), inStride);
+    }
 }
\ No newline at end of file
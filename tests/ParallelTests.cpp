@@ -0,0 +1,98 @@
+/*
+Neil Chatterjee 2020
+
+This serves as a unit test for the parallel batch string conversions of UltraSimpleUUID.
+
+This includes:
+* Parallel String Serialization/Deserialization with a stride
+* Per-element error reporting
+* Caller supplied executors, including a chunk count of 0
+* Strides that are too small
+
+*/
+
+#include <iostream>
+#include "../UltraSimpleUUID.h"
+#include <vector>
+#include <memory>
+
+const size_t TEST_ELEMENT_COUNT = 1000;
+#define UNIT_TEST_ASSERT(expr, msg) if(!expr) { std::cout << "ERROR: " << msg << std::endl; return -1; }
+
+int main(int argc, char* argv[])
+{
+    const size_t stride = UltraSimpleUUID::UUID_STR_LEN + 1; // leave room for a separator
+    std::vector<UltraSimpleUUID::Uuid> ids(TEST_ELEMENT_COUNT);
+    for (auto& id : ids)
+        id.randomize();
+
+    // Test serialization matches toString and respects the stride
+    std::vector<char> chars(TEST_ELEMENT_COUNT * stride, '\n');
+    UltraSimpleUUID::toStringsParallel(ids.data(), TEST_ELEMENT_COUNT, chars.data(), 4, stride);
+    for (size_t i = 0; i < TEST_ELEMENT_COUNT; i++)
+    {
+        UNIT_TEST_ASSERT((std::string(&chars[i * stride], UltraSimpleUUID::UUID_STR_LEN) == ids[i].toString()), "Parallel serialization did not match toString");
+        UNIT_TEST_ASSERT((chars[i * stride + UltraSimpleUUID::UUID_STR_LEN] == '\n'), "Parallel serialization wrote past the end of an element");
+    }
+
+    // Test deserialization with malformed elements
+    {
+        std::vector<char> bad_chars = chars;
+        bad_chars[5 * stride + 8] = 'x';   // missing hyphen
+        bad_chars[700 * stride + 3] = '#'; // illegal character
+        std::vector<UltraSimpleUUID::Uuid> parsed(TEST_ELEMENT_COUNT);
+        std::unique_ptr<bool[]> valid(new bool[TEST_ELEMENT_COUNT]);
+        size_t failures = UltraSimpleUUID::fromStringsParallel(bad_chars.data(), TEST_ELEMENT_COUNT, parsed.data(), valid.get(), 3, stride);
+        UNIT_TEST_ASSERT((failures == 2), "Parallel deserialization reported the wrong number of failures");
+        for (size_t i = 0; i < TEST_ELEMENT_COUNT; i++)
+        {
+            bool expect_valid = (i != 5 && i != 700);
+            UNIT_TEST_ASSERT((valid[i] == expect_valid), "Parallel deserialization reported the wrong element as malformed");
+            UNIT_TEST_ASSERT(((parsed[i] == ids[i]) == expect_valid), "Parallel deserialization produced an unexpected UUID");
+        }
+        UNIT_TEST_ASSERT((parsed[5].isNil()), "Malformed string modified its UUID");
+    }
+
+    // Test caller supplied executors, including a chunk count of 0
+    for (size_t num_chunks : { (size_t)0, (size_t)1, (size_t)7, TEST_ELEMENT_COUNT * 2 })
+    {
+        size_t chunks_run = 0;
+        UltraSimpleUUID::Executor serial_executor = [&](size_t inNumChunks, const std::function<void(size_t)>& inRunChunk) {
+            for (size_t chunk_idx = 0; chunk_idx < inNumChunks; chunk_idx++)
+            {
+                inRunChunk(chunk_idx);
+                chunks_run++;
+            }
+        };
+        std::vector<char> executor_chars(TEST_ELEMENT_COUNT * stride, '\n');
+        UltraSimpleUUID::toStringsParallel(ids.data(), TEST_ELEMENT_COUNT, executor_chars.data(), serial_executor, num_chunks, stride);
+        UNIT_TEST_ASSERT((executor_chars == chars), "Serialization with a caller supplied executor did not match");
+        UNIT_TEST_ASSERT((chunks_run >= 1 && chunks_run <= TEST_ELEMENT_COUNT), "Executor was given an unexpected number of chunks");
+
+        std::vector<UltraSimpleUUID::Uuid> parsed(TEST_ELEMENT_COUNT);
+        size_t failures = UltraSimpleUUID::fromStringsParallel(chars.data(), TEST_ELEMENT_COUNT, parsed.data(), nullptr, serial_executor, num_chunks, stride);
+        UNIT_TEST_ASSERT((failures == 0), "Deserialization with a caller supplied executor reported failures");
+        for (size_t i = 0; i < TEST_ELEMENT_COUNT; i++)
+            UNIT_TEST_ASSERT((parsed[i] == ids[i]), "Deserialization with a caller supplied executor produced an unexpected UUID");
+    }
+
+    // Test a stride that would make elements overlap is rejected
+#ifndef DEEP_TEST_ULTRA_SIMPLE_UUIDS
+    {
+        const size_t short_stride = UltraSimpleUUID::UUID_STR_LEN - 1;
+        std::vector<char> short_chars(TEST_ELEMENT_COUNT * short_stride, '\n');
+        UltraSimpleUUID::toStringsParallel(ids.data(), TEST_ELEMENT_COUNT, short_chars.data(), 4, short_stride);
+        UNIT_TEST_ASSERT((short_chars == std::vector<char>(TEST_ELEMENT_COUNT * short_stride, '\n')), "Serialization with a too small stride wrote output");
+
+        std::vector<UltraSimpleUUID::Uuid> parsed(TEST_ELEMENT_COUNT);
+        std::unique_ptr<bool[]> valid(new bool[TEST_ELEMENT_COUNT]);
+        size_t failures = UltraSimpleUUID::fromStringsParallel(chars.data(), TEST_ELEMENT_COUNT, parsed.data(), valid.get(), 4, short_stride);
+        UNIT_TEST_ASSERT((failures == TEST_ELEMENT_COUNT), "Deserialization with a too small stride did not report every element as malformed");
+        for (size_t i = 0; i < TEST_ELEMENT_COUNT; i++)
+            UNIT_TEST_ASSERT((!valid[i]), "Deserialization with a too small stride reported an element as valid");
+    }
+#endif //DEEP_TEST_ULTRA_SIMPLE_UUIDS
+
+    std::cout << "Done\n";
+    return 0;
+}
@@ -0,0 +1,85 @@
+/*
+
+Neil Chatterjee 2020
+
+This test measures how toStringsParallel and fromStringsParallel scale from 1 thread up to every hardware thread.
+By default it converts 100 million UUIDs, which needs roughly 8.5GB of memory. Pass a smaller element count as the
+first argument if your machine doesn't have that much, e.g. `ScalingTests 10000000`
+
+*/
+#include "../UltraSimpleUUID.h"
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+const size_t DEFAULT_ELEMENT_COUNT = 100000000;
+const size_t SAMPLE_COUNT = 1024;                      // Number of elements checked after each round trip
+
+///@brief: Time a function call in milliseconds
+template <typename Function>
+unsigned long long timeMilliseconds(Function inFunction)
+{
+    std::chrono::time_point<std::chrono::steady_clock> start_time = std::chrono::steady_clock::now();
+    inFunction();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time).count();
+}
+
+int main(int argc, char* argv[])
+{
+    size_t element_count = argc > 1 ? std::stoull(argv[1]) : DEFAULT_ELEMENT_COUNT;
+    unsigned max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::cout << "Preparing " << element_count << " UUIDs..." << std::endl;
+    std::vector<UltraSimpleUUID::Uuid> uuids(element_count);
+    {
+        // randomize() is slow, so combine a handful of random UUIDs with the index instead
+        std::vector<UltraSimpleUUID::Uuid> seeds(64);
+        for (auto& seed : seeds)
+            seed.randomize();
+        for (size_t i = 0; i < element_count; i++)
+        {
+            uuids[i] = seeds[i % seeds.size()];
+            uuids[i].combine(std::to_string(i));
+        }
+    }
+    std::vector<char> chars(element_count * UltraSimpleUUID::UUID_STR_LEN);
+    std::vector<UltraSimpleUUID::Uuid> parsed(element_count);
+
+    std::cout << "Threads\tToStrings(ms)\tFromStrings(ms)\tToStrings speedup\tFromStrings speedup" << std::endl;
+    unsigned long long base_to_ms = 0;
+    unsigned long long base_from_ms = 0;
+    for (unsigned threads = 1; threads <= max_threads; threads++)
+    {
+        unsigned long long to_ms = timeMilliseconds([&]() {
+            UltraSimpleUUID::toStringsParallel(uuids.data(), element_count, chars.data(), threads);
+        });
+        std::fill(parsed.begin(), parsed.end(), UltraSimpleUUID::Uuid()); // so a skipped chunk can't pass on the previous run's values
+        size_t failures = 0;
+        unsigned long long from_ms = timeMilliseconds([&]() {
+            failures = UltraSimpleUUID::fromStringsParallel(chars.data(), element_count, parsed.data(), nullptr, threads);
+        });
+        bool round_trip_ok = (failures == 0);
+        for (size_t sample = 0; sample < SAMPLE_COUNT && round_trip_ok && element_count > 0; sample++)
+        {
+            // spread the samples over every chunk, always including the first and last element
+            size_t i = (element_count - 1) * sample / (SAMPLE_COUNT - 1);
+            round_trip_ok = (parsed[i] == uuids[i]) &&
+                std::string(&chars[i * UltraSimpleUUID::UUID_STR_LEN], UltraSimpleUUID::UUID_STR_LEN) == uuids[i].toString();
+        }
+        if (!round_trip_ok)
+        {
+            std::cout << "ERROR: parallel round trip failed" << std::endl;
+            return -1;
+        }
+        if (threads == 1)
+        {
+            base_to_ms = std::max(1ull, to_ms);
+            base_from_ms = std::max(1ull, from_ms);
+        }
+        std::cout << threads << "\t" << to_ms << "\t\t" << from_ms << "\t\t"
+            << (double)base_to_ms / (double)std::max(1ull, to_ms) << "x\t\t\t"
+            << (double)base_from_ms / (double)std::max(1ull, from_ms) << "x" << std::endl;
+    }
+}